@@ -0,0 +1,139 @@
+#define yyEnable_Aliases
+#define yyEnable_Benchmarking
+#include <y.hpp>
+
+// Timings of the bulk paths of 'y.hpp' against their plain alternatives.
+// Sorting callbacks also rebuild their input, the 'copy' lines are that baseline.
+
+namespace {
+
+constexpr usize sort_count = 4'000'000;
+constexpr u32 sort_runs = 5;
+
+constexpr usize pack_count = 4'000'000;
+constexpr u32 pack_runs = 20;
+
+template <typename K>
+Vec<K> random_keys(y::Rng &rng, usize count) {
+    Vec<K> keys(count);
+    for (K &k : keys) {
+        if constexpr (std::floating_point<K>) {
+            k = rng.uniform<K>(K(-1e6), K(1e6));
+        } else {
+            k = K(rng.next());
+        }
+    }
+    return keys;
+}
+
+template <typename K>
+void sort_keys(y::Benchmark &B, StrView type, Vec<K> const &keys) {
+    Vec<K> work;
+    B.run(y_fmt("{} copy", type), sort_runs, [&] { work = keys; });
+    B.run(y_fmt("{} std::sort", type), sort_runs, [&] {
+        work = keys;
+        std::sort(work.begin(), work.end());
+    });
+    B.run(y_fmt("{} radix_sort", type), sort_runs, [&] {
+        work = keys;
+        y::radix_sort(work);
+    });
+    B.run(y_fmt("{} radix_sort parallel", type), sort_runs, [&] {
+        work = keys;
+        y::radix_sort(work, true);
+    });
+}
+
+} // namespace
+
+int main() {
+
+    y::Benchmark B {};
+    B.set_align_column(40);
+    y::Rng rng { 7 };
+
+
+    y_println("Sorting {} keys", sort_count);
+    {
+        sort_keys(B, "u32", random_keys<u32>(rng, sort_count));
+        sort_keys(B, "u64", random_keys<u64>(rng, sort_count));
+        sort_keys(B, "f32", random_keys<f32>(rng, sort_count));
+
+        Vec<u32> const keys = random_keys<u32>(rng, sort_count);
+        Vec<u32> work_keys, work_values;
+        Vec<std::pair<u32, u32>> pairs;
+        B.run("u32 : u32 std::stable_sort", sort_runs, [&] {
+            pairs.resize(keys.size());
+            for (usize i = 0; i < keys.size(); ++i) {
+                pairs[i] = { keys[i], u32(i) };
+            }
+            std::stable_sort(pairs.begin(), pairs.end(), [](auto const &a, auto const &b) { return a.first < b.first; });
+        });
+        B.run("u32 : u32 radix_sort", sort_runs, [&] {
+            work_keys = keys;
+            work_values.resize(keys.size());
+            std::iota(work_values.begin(), work_values.end(), 0u);
+            y::radix_sort(work_keys, work_values);
+        });
+        B.run("u32 : u32 radix_sort parallel", sort_runs, [&] {
+            work_keys = keys;
+            work_values.resize(keys.size());
+            std::iota(work_values.begin(), work_values.end(), 0u);
+            y::radix_sort(work_keys, work_values, true);
+        });
+        B.run("u32 radix_order", sort_runs, [&] { work_values = y::radix_order(keys); });
+    }
+
+
+    // The 'scalar' lines are element by element loops over the scalar conversions
+    y_println("Packing {} floats", pack_count);
+    {
+        Vec<f32> floats(pack_count);
+        rng.fill(Span<f32> { floats }, -1.f, 1.f);
+        Vec<f32> back(pack_count);
+
+        Vec<y::f16> halfs(pack_count);
+        B.run("f16 pack scalar", pack_runs, [&] {
+            for (usize i = 0; i < floats.size(); ++i) {
+                halfs[i].bits = y::f16::from_f32(floats[i]);
+            }
+        });
+        B.run("f16 pack_f16", pack_runs, [&] { y::pack_f16(floats, halfs); });
+        B.run("f16 unpack scalar", pack_runs, [&] {
+            for (usize i = 0; i < halfs.size(); ++i) {
+                back[i] = y::f16::to_f32(halfs[i].bits);
+            }
+        });
+        B.run("f16 unpack_f16", pack_runs, [&] { y::unpack_f16(halfs, back); });
+
+        Vec<u8> bytes(pack_count);
+        B.run("u8 pack scalar", pack_runs, [&] {
+            for (usize i = 0; i < floats.size(); ++i) {
+                bytes[i] = y::pack_unorm<u8>(floats[i]);
+            }
+        });
+        B.run("u8 pack_unorm", pack_runs, [&] { y::pack_unorm(floats, bytes); });
+        B.run("u8 unpack scalar", pack_runs, [&] {
+            for (usize i = 0; i < bytes.size(); ++i) {
+                back[i] = y::unpack_unorm(bytes[i]);
+            }
+        });
+        B.run("u8 unpack_unorm", pack_runs, [&] { y::unpack_unorm(bytes, back); });
+
+        Vec<i16> shorts(pack_count);
+        B.run("i16 pack scalar", pack_runs, [&] {
+            for (usize i = 0; i < floats.size(); ++i) {
+                shorts[i] = y::pack_snorm<i16>(floats[i]);
+            }
+        });
+        B.run("i16 pack_snorm", pack_runs, [&] { y::pack_snorm(floats, shorts); });
+        B.run("i16 unpack scalar", pack_runs, [&] {
+            for (usize i = 0; i < shorts.size(); ++i) {
+                back[i] = y::unpack_snorm(shorts[i]);
+            }
+        });
+        B.run("i16 unpack_snorm", pack_runs, [&] { y::unpack_snorm(shorts, back); });
+    }
+
+    return 0;
+}
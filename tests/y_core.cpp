@@ -5,6 +5,26 @@
 #define yyLib_Glm
 #include <y.hpp>
 
+namespace {
+
+// Ordered map key that counts how many times it is built from a probe, so tests can tell lookups apart from inserts
+struct KeyProbe {
+    StrView name;
+};
+
+struct CountedKey {
+    static inline i32 built = 0;
+    Str name;
+
+    CountedKey(KeyProbe probe) : name(probe.name) { ++built; }
+    b8 operator<(CountedKey const &other) const { return name < other.name; }
+};
+
+b8 operator<(CountedKey const &key, KeyProbe const &probe) { return key.name < probe.name; }
+b8 operator<(KeyProbe const &probe, CountedKey const &key) { return probe.name < key.name; }
+
+} // namespace
+
 int main() {
 
     y::Test T {};
@@ -23,6 +43,36 @@ int main() {
     }
 
 
+    T.make_section("Function Refs");
+    {
+        i32 calls = 0;
+        auto const add = [&calls](i32 n) { return calls += n; };
+        y::FnRef<i32(i32)> ref = add;
+        T.eq("Call", ref(2), 2);
+        T.eq("Call Again", ref(3), 5);
+
+        i32 (*const fn_ptr)(i32) = [](i32 n) { return n * 2; };
+        y::FnRef<i32(i32)> ref_ptr = fn_ptr;
+        T.eq("Function Pointer", ref_ptr(21), 42);
+
+        Fn<void()> const empty {};
+        T.ok("Empty", !y::FnRef<void()> {} && !y::FnRef<void()> { empty });
+
+        Arr<i32, 8> big { 1, 2, 3, 4, 5, 6, 7, 8 };
+        y::InplaceFn<i32(), 64> owned = [big] { return big[7]; };
+        T.eq("Inplace Call", owned(), 8);
+        y::InplaceFn<i32(), 64> moved = std::move(owned);
+        T.ok("Inplace Move", !owned && moved() == 8);
+
+        auto const shared = y::s_new<i32>(7);
+        {
+            y::InplaceFn<i32()> keep = [shared] { return *shared; };
+            T.eq("Inplace Owns", shared.use_count(), 2);
+        }
+        T.eq("Inplace Destroys", shared.use_count(), 1);
+    }
+
+
     T.make_section("Defer Ref");
     {
         i32 count = 0;
@@ -47,6 +97,34 @@ int main() {
     }
 
 
+    T.make_section("Lazy GC");
+    {
+        Str order {};
+        {
+            y::LazyGC gc {};
+            gc.add([&] { order += "1"; }).add([&] { order += "2"; });
+            gc.add(VoidFn { [&] { order += "3"; } });
+            T.ok("Deferred", order.empty());
+        }
+        T.eq("Reverse Order", order, "321");
+
+        order.clear();
+        y::LazyGC outer {};
+        {
+            y::LazyGC inner {};
+            for (i32 i = 0; i < 12; ++i) {
+                inner.add([&order, i] { order += y_fmt("{}", i % 10); });
+            }
+            outer = std::move(inner);
+        }
+        T.ok("Move Keeps", order.empty());
+        outer.release();
+        T.eq("Release", order, "109876543210");
+        outer.release();
+        T.eq("Release Once", order.size(), 12);
+    }
+
+
     T.make_section("Str Format");
     {
         T.eq("Str", y_fmt("Test {}", "String"), "Test String");
@@ -56,6 +134,471 @@ int main() {
     }
 
 
+    T.make_section("Enum Reflection");
+    {
+        enum class Color : i8 { Red = -2, Green = 0, Blue = 7 };
+        enum Flag { Flag_A = 1, Flag_B = 2 };
+
+        T.eq("Name", y::enum_name(Color::Red), "Red");
+        T.eq("Name Unscoped", y::enum_name(Flag_B), "Flag_B");
+        T.ok("Name Invalid", y::enum_name(Color(3)).empty());
+        T.eq("Count", y::enum_count<Color>(), 3);
+        T.ok("Values", y::enum_values<Color>()[2] == Color::Blue);
+        T.eq("Names", y::enum_names<Flag>()[0], "Flag_A");
+        T.ok("From Str", y::enum_from_str<Color>("Green") == Color::Green);
+        T.ok("From Str Invalid", !y::enum_from_str<Color>("Yellow").has_value());
+        T.eq("Format", y_fmt("{} {}", Color::Blue, Color(3)), "Blue 3");
+
+        static_assert(y::enum_name(Color::Green) == "Green");
+    }
+
+
+    T.make_section("Math");
+    {
+        T.eq("Clamp", y::clamp(15, 0, 10), 10);
+        T.eq("Map 100", y::map_100(50.f, 0.f, 2.f), 1.f);
+        T.eq("Clamp Angle f64", y::clamp_angle(-90.0), 270.0);
+
+        Vec<f32> floats;
+        Vec<f64> doubles;
+        Vec<i32> ints;
+        for (i32 i = 0; i < 1003; ++i) {
+            floats.push_back(f32(i - 500) * 1.5f);
+            doubles.push_back(f64(i - 500) * 1.5);
+            ints.push_back(i - 500);
+        }
+        auto angles = floats;
+        auto angles64 = doubles;
+        auto mapped = floats;
+
+        y::clamp_all(floats, -100.f, 100.f);
+        Span<f64> doubles_span { doubles };
+        y::clamp_all(doubles_span, -100.0, 100.0);
+        y::clamp_all<i32>(ints, -10, 10);
+        T.ok("Clamp All", floats.front() == -100.f && floats[500] == 0.f && floats.back() == 100.f &&
+                            doubles.back() == 100.0 && ints.front() == -10 && ints[505] == 5);
+
+        y::map_all(mapped, -750, 750, 0, 1);
+        T.ok("Map All", y::fuzzy_eq(mapped.front(), 0.f) && y::fuzzy_eq(mapped[500], 0.5f) && y::fuzzy_eq(mapped[999], 0.9993f));
+
+        y::clamp_angle_all(angles);
+        y::clamp_angle_all<f64>(angles64);
+        b8 all_match = true;
+        for (usize i = 0; i < angles.size(); ++i) {
+            all_match = all_match && angles[i] >= 0.f && angles[i] < 360.f &&
+                        y::fuzzy_eq(angles[i], y::clamp_angle(f32(i32(i) - 500) * 1.5f)) &&
+                        y::fuzzy_eq(angles64[i], y::clamp_angle(f64(i32(i) - 500) * 1.5));
+        }
+        T.ok("Clamp Angle All", all_match);
+
+        // Same huge angles in SIMD lanes and in the scalar tail, past the range of a plain i32 conversion
+        Vec<f32> huge { 1e12f, -3e10f, 8.5e8f, -4e12f, 1e12f, -3e10f, -4e12f };
+        auto const huge_expected = huge;
+        y::clamp_angle_all(huge);
+        b8 huge_match = true;
+        for (usize i = 0; i < huge.size(); ++i) {
+            huge_match = huge_match && huge[i] == y::clamp_angle(huge_expected[i]);
+        }
+        T.ok("Clamp Angle All Huge", huge_match && huge[0] == huge[4] && huge[1] == huge[5] && huge[3] == huge[6]);
+    }
+
+    T.make_section("Packing");
+    {
+        b8 round_trip = true;
+        for (u32 bits = 0; bits <= 0xFFFF; ++bits) {
+            y::f16 const h = y::f16::from_bits(u16(bits));
+            b8 const is_nan = (bits & 0x7C00) == 0x7C00 && (bits & 0x03FF) != 0;
+            round_trip = round_trip && (is_nan ? std::isnan(f32(h)) : y::f16(f32(h)) == h);
+        }
+        T.ok("F16 Every Half Round Trips", round_trip);
+
+        T.eq("F16 One", y::f16(1.f).bits, 0x3C00);
+        T.eq("F16 Max", f32(y::f16(65504.f)), 65504.f);
+        T.eq("F16 Overflow", f32(y::f16(1e6f)), std::numeric_limits<f32>::infinity());
+        T.eq("F16 Subnormal", f32(y::f16(5.9604645e-8f)), 5.9604645e-8f);
+        T.eq("F16 Ties To Even", y::f16(1.f + 1.f / 2048.f).bits, 0x3C00);
+
+        Vec<f32> values;
+        for (i32 i = -5000; i <= 5000; ++i) {
+            values.push_back(f32(i) * 0.0002f);
+        }
+        Vec<y::f16> halfs(values.size());
+        Vec<f32> back(values.size());
+        y::pack_f16(values, halfs);
+        y::unpack_f16(halfs, back);
+        f32 max_rel = 0.f;
+        for (usize i = 0; i < values.size(); ++i) {
+            if (std::abs(values[i]) > 6.2e-5f) { // Normal halfs
+                max_rel = std::max(max_rel, std::abs(back[i] - values[i]) / std::abs(values[i]));
+            }
+        }
+        T.lt_or_eq("F16 Span Rel Error", max_rel, 1.f / 2048.f);
+
+        Vec<i8> s8(values.size());
+        Vec<i16> s16(values.size());
+        Vec<u8> u8s(values.size());
+        Vec<u16> u16s(values.size());
+        y::pack_snorm(values, s8);
+        y::pack_snorm<i16>(values, s16);
+        y::pack_unorm(values, u8s);
+        y::pack_unorm<u16>(values, u16s);
+
+        auto const max_error = [&](auto const &packed, auto unpack, f32 lo) {
+            Vec<f32> out(packed.size());
+            unpack(packed, out);
+            f32 max = 0.f;
+            for (usize i = 0; i < values.size(); ++i) {
+                max = std::max(max, std::abs(out[i] - std::max(values[i], lo)));
+            }
+            return max;
+        };
+        T.lt_or_eq("Snorm8", max_error(s8, [](auto const &in, auto &out) { y::unpack_snorm(in, out); }, -1.f), 0.5f / 127.f + 1e-6f);
+        T.lt_or_eq("Snorm16", max_error(s16, [](auto const &in, auto &out) { y::unpack_snorm<i16>(in, out); }, -1.f), 0.5f / 32767.f + 1e-6f);
+        T.lt_or_eq("Unorm8", max_error(u8s, [](auto const &in, auto &out) { y::unpack_unorm(in, out); }, 0.f), 0.5f / 255.f + 1e-6f);
+        T.lt_or_eq("Unorm16", max_error(u16s, [](auto const &in, auto &out) { y::unpack_unorm<u16>(in, out); }, 0.f), 0.5f / 65535.f + 1e-6f);
+        T.ok("Snorm Extremes", y::pack_snorm<i8>(-1.f) == -127 && y::pack_snorm<i8>(2.f) == 127 && y::unpack_snorm(i8(-128)) == -1.f);
+
+        // SIMD span lanes and scalar tails against the scalar conversions, specials included
+        Vec<f32> edges { std::numeric_limits<f32>::quiet_NaN(), std::numeric_limits<f32>::infinity(),
+                         -std::numeric_limits<f32>::infinity(), -0.f, 1e-45f, 6.1e-5f, 65520.f, -1.5f, 0.5f / 255.f };
+        edges.insert(edges.end(), values.begin(), values.begin() + 102);
+        Vec<y::f16> edge_halfs(edges.size());
+        Vec<f32> edge_back(edges.size());
+        Vec<u8> edge_u8(edges.size());
+        Vec<i16> edge_i16(edges.size());
+        y::pack_f16(edges, edge_halfs);
+        y::unpack_f16(edge_halfs, edge_back);
+        y::pack_unorm(edges, edge_u8);
+        y::pack_snorm(edges, edge_i16);
+        b8 same = true;
+        for (usize i = 0; i < edges.size(); ++i) {
+            f32 const half_back = f32(y::f16::from_bits(edge_halfs[i].bits));
+            same = same && edge_halfs[i] == y::f16(edges[i]) &&
+                   std::bit_cast<u32>(edge_back[i]) == std::bit_cast<u32>(half_back) &&
+                   edge_u8[i] == y::pack_unorm<u8>(edges[i]) && edge_i16[i] == y::pack_snorm<i16>(edges[i]);
+        }
+        T.ok("Span Matches Scalar", same && edge_u8[0] == 0 && edge_i16[0] == -32767);
+    }
+
+    T.make_section("Octahedral Normals");
+    {
+        Vec<Vec3> normals;
+        for (i32 i = 0; i < 64; ++i) {
+            for (i32 j = 0; j < 64; ++j) {
+                f32 const theta = f32(i) / 63.f * 3.14159265f;
+                f32 const phi = f32(j) / 64.f * 6.28318531f;
+                normals.emplace_back(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+            }
+        }
+        auto const max_degrees = [&](auto tag) {
+            using I = decltype(tag);
+            Vec<std::array<I, 2>> packed(normals.size());
+            Vec<Vec3> decoded(normals.size());
+            y::pack_oct(normals, packed);
+            y::unpack_oct(packed, decoded);
+            f32 max = 0.f;
+            for (usize i = 0; i < normals.size(); ++i) {
+                f32 const sin = glm::length(glm::cross(normals[i], decoded[i]));
+                max = std::max(max, std::atan2(sin, glm::dot(normals[i], decoded[i])) * 57.2957795f);
+            }
+            return max;
+        };
+        T.lt_or_eq("Oct8 Degrees", max_degrees(i8 {}), 1.5f);
+        T.lt_or_eq("Oct16 Degrees", max_degrees(i16 {}), 0.01f);
+
+        Vec<Vec4> colors { Vec4(0.f, 0.25f, 0.5f, 1.f), Vec4(1.f, 0.75f, 0.1f, 0.f) };
+        Vec<u8> rgba(colors.size() * 4);
+        y::pack_unorm(y::as_floats(colors), rgba);
+        T.ok("Vec4 Colors", rgba[1] == 64 && rgba[3] == 255 && rgba[5] == 191 && rgba[7] == 0);
+    }
+
+    T.make_section("Random");
+    {
+        y::Rng a { 42 };
+        y::Rng b { 42 };
+        b8 same = true;
+        for (i32 i = 0; i < 100; ++i) {
+            same = same && a() == b();
+        }
+        T.ok("Deterministic", same);
+        T.ok("Seeds Differ", y::Rng { 1 }() != y::Rng { 2 }());
+
+        y::Rng stream = a.fork();
+        T.ok("Fork", stream() != a());
+
+        Arr<i32, 7> counts {};
+        b8 in_range = true;
+        for (i32 i = 0; i < 70000; ++i) {
+            i32 const v = a.uniform(-3, 3);
+            in_range = in_range && v >= -3 && v <= 3;
+            ++counts[usize(v + 3)];
+        }
+        T.ok("Int Range", in_range && a.uniform(5, 5) == 5 && a.uniform(i64_min, i64_max) != a.uniform(i64_min, i64_max));
+        T.ok("Int Uniform", std::ranges::all_of(counts, [](i32 c) { return c > 9500 && c < 10500; }));
+
+        f64 sum = 0.0, sum_normal = 0.0, sum_normal_sq = 0.0;
+        for (i32 i = 0; i < 100000; ++i) {
+            f32 const u = a.uniform<f32>();
+            in_range = in_range && u >= 0.f && u < 1.f;
+            sum += u;
+            f32 const n = a.normal(2.f, 3.f);
+            sum_normal += n;
+            sum_normal_sq += f64(n) * n;
+        }
+        f64 const mean = sum_normal / 100000.0;
+        T.ok("Float", in_range && y::fuzzy_eq(sum / 100000.0, 0.5, 0.01));
+        T.ok("Normal", y::fuzzy_eq(mean, 2.0, 0.05) && y::fuzzy_eq(std::sqrt(sum_normal_sq / 100000.0 - mean * mean), 3.0, 0.05));
+
+        y::Rng reseeded { 5 };
+        (void)reseeded.normal();
+        reseeded.reseed(6);
+        T.eq("Normal After Reseed", reseeded.normal(), y::Rng { 6 }.normal());
+        y::Rng parent { 8 };
+        (void)parent.normal();
+        y::Rng forked = parent.fork();
+        T.ok("Normal After Fork", parent.normal() != forked.normal());
+
+        Vec<u32> bits(1003);
+        Vec<f32> floats(1001);
+        y::Rng c { 7 };
+        y::Rng d { 7 };
+        c.fill(bits);
+        Vec<u32> bits_again(bits.size());
+        d.fill(bits_again);
+        T.ok("Fill Deterministic", bits == bits_again && bits[0] != bits[1] && bits[1001] != bits[1002]);
+
+        c.fill(floats, -2.f, 2.f);
+        f64 floats_sum = 0.0;
+        for (f32 const f : floats) {
+            in_range = in_range && f >= -2.f && f < 2.f;
+            floats_sum += f;
+        }
+        T.ok("Fill Floats", in_range && std::abs(floats_sum / 1001.0) < 0.15);
+    }
+
+    T.make_section("Random Unit Vec3");
+    {
+        y::Rng rng { 3 };
+        Vec3 sum { 0.f };
+        b8 unit = true;
+        for (i32 i = 0; i < 10000; ++i) {
+            Vec3 const v = rng.unit_vec3();
+            unit = unit && y::fuzzy_eq(glm::length(v), 1.f, 1e-5f);
+            sum += v;
+        }
+        T.ok("Unit Vec3", unit && glm::length(sum / 10000.f) < 0.03f);
+    }
+
+    T.make_section("Noise");
+    {
+        Vec<Vec3> points;
+        for (i32 i = 0; i < 4099; ++i) {
+            points.push_back(Vec3 { f32(i % 17) * 0.37f - 3.f, f32(i % 29) * 0.21f + 1.f, f32(i) * 0.013f - 20.f });
+        }
+        Vec<f32> batch(points.size());
+        y::noise::simplex(points, batch, 42);
+
+        b8 in_range = true, matches = true, seeded = true;
+        f32 lo = 1.f, hi = -1.f;
+        for (usize i = 0; i < points.size(); ++i) {
+            f32 const n = y::noise::simplex(points[i], 42);
+            in_range = in_range && n >= -1.f && n <= 1.f;
+            matches = matches && y::fuzzy_eq(n, batch[i], 1e-6f);
+            lo = std::min(lo, n);
+            hi = std::max(hi, n);
+        }
+        for (usize i = 0; i < 64; ++i) {
+            seeded = seeded && y::noise::simplex(points[i], 42) == y::noise::simplex(points[i], 42);
+        }
+        T.ok("Simplex 3D range", in_range && lo < -0.5f && hi > 0.5f);
+        T.ok("Simplex 3D batch", matches);
+        T.ok("Simplex deterministic", seeded);
+        T.ok("Simplex seed", y::noise::simplex(points[7], 1) != y::noise::simplex(points[7], 2));
+        T.eq("Simplex at lattice", y::noise::simplex(Vec3 { 0.f }), 0.f);
+
+        Vec<Vec2> plane;
+        for (i32 i = 0; i < 1031; ++i) {
+            plane.push_back(Vec2 { f32(i % 31) * 0.29f - 4.f, f32(i / 31) * 0.31f });
+        }
+        Vec<f32> plane_batch(plane.size()), plane_fbm(plane.size());
+        y::noise::simplex(plane, plane_batch);
+        y::noise::fbm(SpanConst<Vec2> { plane }, plane_fbm);
+        b8 plane_ok = true, fbm_ok = true;
+        for (usize i = 0; i < plane.size(); ++i) {
+            f32 const n = y::noise::simplex(plane[i]);
+            plane_ok = plane_ok && n >= -1.f && n <= 1.f && y::fuzzy_eq(n, plane_batch[i], 1e-6f);
+            f32 const f = y::noise::fbm(plane[i]);
+            fbm_ok = fbm_ok && f >= -1.f && f <= 1.f && y::fuzzy_eq(f, plane_fbm[i], 1e-6f);
+        }
+        T.ok("Simplex 2D", plane_ok);
+        T.ok("Fbm 2D", fbm_ok);
+
+        y::noise::Fbm const rough { .octaves = 3, .lacunarity = 2.5f, .gain = 0.6f };
+        y::noise::fbm(points, batch, rough, 5);
+        T.ok("Fbm 3D batch", y::fuzzy_eq(y::noise::fbm(points[123], rough, 5), batch[123], 1e-6f));
+    }
+
+    T.make_section("Stats");
+    {
+        y::Rng rng { 17 };
+        Vec<f32> f(1027);
+        rng.fill(Span<f32> { f }, -5.f, 15.f);
+        Vec<f64> d(f.begin(), f.end());
+
+        f64 naive_sum = 0.0;
+        for (f64 v : d) {
+            naive_sum += v;
+        }
+        f64 const naive_mean = naive_sum / f64(d.size());
+        f64 naive_var = 0.0;
+        for (f64 v : d) {
+            naive_var += (v - naive_mean) * (v - naive_mean);
+        }
+        naive_var /= f64(d.size());
+
+        T.ok("Sum f32", y::fuzzy_eq(y::reduce::sum(f), naive_sum, 1e-9));
+        T.ok("Sum f64", y::fuzzy_eq(y::reduce::sum(d), naive_sum, 1e-9));
+        T.eq("Min", y::reduce::min(f), *std::min_element(f.begin(), f.end()));
+        T.eq("Max", y::reduce::max(d), *std::max_element(d.begin(), d.end()));
+        T.ok("Mean", y::fuzzy_eq(y::reduce::mean(f), naive_mean, 1e-12));
+        T.ok("Var", y::fuzzy_eq(y::reduce::var(d), naive_var, 1e-9));
+        T.eq("Empty", y::reduce::sum(SpanConst<f32> {}), 0.0);
+
+        y::Stats one_by_one, halves_a, halves_b, spans;
+        for (f64 v : d) {
+            one_by_one.add(v);
+        }
+        for (usize i = 0; i < d.size(); ++i) {
+            (i < 300 ? halves_a : halves_b).add(d[i]);
+        }
+        halves_a.merge(halves_b);
+        spans.add(SpanConst<f32> { f.data(), 500 });
+        spans.add(SpanConst<f32> { f.data() + 500, f.size() - 500 });
+        y::Stats whole;
+        whole.add(d);
+        T.ok("Stats Vec", whole.count() == d.size() && y::fuzzy_eq(whole.variance(), naive_var, 1e-9));
+        for (y::Stats const *st : { &one_by_one, &halves_a, &spans }) {
+            T.ok("Stats", st->count() == d.size() && y::fuzzy_eq(st->mean(), naive_mean, 1e-9)
+                              && y::fuzzy_eq(st->variance(), naive_var, 1e-9) && st->min() == y::reduce::min(SpanConst<f64> { d })
+                              && st->max() == y::reduce::max(SpanConst<f64> { d }));
+        }
+        T.ok("Sample variance", y::fuzzy_eq(one_by_one.sample_variance(), naive_var * f64(d.size()) / f64(d.size() - 1), 1e-9));
+
+        Vec<i32> ints { 7, 1, 5, 3, 9 };
+        T.eq("Median", y::quantile(ints, 0.5), 5.0);
+        T.eq("Quantile 0", y::quantile(ints, 0.0), 1.0);
+        T.eq("Quantile 1", y::quantile(ints, 1.0), 9.0);
+        T.eq("Quantile interp", y::quantile(ints, 0.375), 4.0);
+
+        y::P2Quantile p50 { 0.5 }, p99 { 0.99 };
+        for (i32 i = 0; i < 100000; ++i) {
+            f64 const x = rng.uniform<f64>();
+            p50.add(x);
+            p99.add(x);
+        }
+        T.ok("P2 median", std::abs(p50.value() - 0.5) < 0.01);
+        T.ok("P2 p99", std::abs(p99.value() - 0.99) < 0.005);
+        y::P2Quantile few { 0.5 };
+        few.add(3.0);
+        few.add(1.0);
+        few.add(2.0);
+        T.eq("P2 few", few.value(), 2.0);
+        y::P2Quantile five_high { 0.99 }, five_low { 0.1 };
+        for (f64 const x : { 4.0, 1.0, 5.0, 3.0, 2.0 }) {
+            five_high.add(x);
+            five_low.add(x);
+        }
+        T.ok("P2 five, q != 0.5", five_high.value() == 5.0 && five_low.value() == 1.0);
+    }
+
+    T.make_section("Histogram");
+    {
+        y::Histogram h;
+        Vec<u64> samples;
+        y::Rng rng { 23 };
+        for (i32 i = 0; i < 20000; ++i) {
+            u64 const v = u64(std::exp(rng.uniform<f64>(0.0, 20.0)));
+            samples.push_back(v);
+            h.record(v);
+        }
+        std::sort(samples.begin(), samples.end());
+        T.eq("Count", h.count(), samples.size());
+        T.eq("P0", h.percentile(0.0), samples.front());
+        T.eq("P100", h.percentile(100.0), samples.back());
+
+        b8 precise = true;
+        for (f64 p : { 1.0, 25.0, 50.0, 90.0, 99.0, 99.9 }) {
+            u64 const exact = samples[usize(std::ceil(p / 100.0 * f64(samples.size()))) - 1];
+            u64 const approx = h.percentile(p);
+            precise = precise && approx >= exact && f64(approx - exact) <= f64(exact) / 128.0 + 1.0;
+        }
+        T.ok("Percentiles", precise);
+
+        y::Histogram low { 2 };
+        low.record(0);
+        low.record(std::numeric_limits<u64>::max(), 3);
+        T.eq("Extremes", low.percentile(50.0), std::numeric_limits<u64>::max());
+        T.eq("Extremes min", low.min(), 0);
+
+        y::Histogram a, b;
+        for (usize i = 0; i < samples.size(); ++i) {
+            (i % 3 ? a : b).record(samples[i]);
+        }
+        a.merge(b);
+        T.eq("Merge", a.percentile(99.0), h.percentile(99.0));
+        T.ok("Merge mean", y::fuzzy_eq(a.mean(), h.mean(), 1e-6 * h.mean()));
+
+        Vec<u8> const bytes = h.serialize();
+        auto const back = y::Histogram::deserialize(bytes);
+        T.ok("Serialize", back.has_value() && *back == h);
+        T.lt("Serialize compact", bytes.size(), 20000);
+        T.ok("Deserialize malformed", !y::Histogram::deserialize(SpanConst<u8> { bytes.data(), bytes.size() - 1 }).has_value());
+
+        y::Histogram two;
+        two.record(5);
+        two.record(1000); // Last pair : delta 501 (2 bytes), count 1 (1 byte)
+        Vec<u8> const two_bytes = two.serialize();
+        T.ok("Deserialize missing pair", y::Histogram::deserialize(two_bytes).has_value() &&
+                                            !y::Histogram::deserialize(SpanConst<u8> { two_bytes.data(), two_bytes.size() - 3 }).has_value());
+        Vec<u8> overflow { 'y', 'H', 1, 7 };
+        overflow.insert(overflow.end(), 9, 0xFF);
+        overflow.push_back(0x02);
+        T.ok("Deserialize varint overflow", !y::Histogram::deserialize(overflow).has_value());
+
+        // min 3, max 5, sum 0, total 1, then the bucket of 4
+        Vec<u8> bounds { 'y', 'H', 1, 7, 3, 5, 0, 1, 4, 1 };
+        T.ok("Deserialize bounds", y::Histogram::deserialize(bounds).has_value());
+        std::swap(bounds[4], bounds[5]);
+        T.ok("Deserialize min above max", !y::Histogram::deserialize(bounds).has_value());
+        // Total 1 from two buckets of 2^64 - 1 and 2, the running count wraps back to 1
+        Vec<u8> wrap { 'y', 'H', 1, 7, 3, 5, 0, 1, 4 };
+        wrap.insert(wrap.end(), 9, 0xFF);
+        wrap.insert(wrap.end(), { 0x01, 1, 2 });
+        T.ok("Deserialize count wrap", !y::Histogram::deserialize(wrap).has_value());
+
+        y::Histogram reused = h;
+        reused.reset();
+        T.ok("Reset", reused == y::Histogram {} && reused.min() == 0 && reused.percentile(50.0) == 0);
+        reused.record(7);
+        T.ok("Reset record", reused.count() == 1 && reused.min() == 7 && reused.max() == 7);
+
+        y::Histogram high;
+        high.record(1001);
+        high.record(5000);
+        high.record(90000);
+        T.eq("P0 above exact buckets", high.percentile(0.0), 1001);
+        T.eq("Min above exact buckets", high.min(), 1001);
+
+        using namespace std::chrono_literals;
+        y::Histogram laps;
+        auto timer = y::ETimer {}.reset();
+        std::this_thread::sleep_for(2ms);
+        timer.record(laps);
+        timer.record(laps);
+        T.eq("Timer laps", laps.count(), 2);
+        T.gt("Timer record", laps.max(), 1'000'000);
+    }
+
     T.make_section("Bit Ops");
     {
         T.eq("Bit 1", y::bit(1), 2);
@@ -63,6 +606,260 @@ int main() {
         T.eq("Bit 3", y::bit(3), 8);
         T.eq("Bit 4", y::bit(4), 16);
         T.eq("Bit 5", y::bit(5), 32);
+        T.eq("Bit 40", y::bit(40), usize(1) << 40);
+    }
+
+    T.make_section("Bits");
+    {
+        T.eq("Popcount", y::bits::popcount(0xF0F0u), 8u);
+        T.eq("Clz", y::bits::clz(u32(1)), 31u);
+        T.eq("Clz zero", y::bits::clz(u16(0)), 16u);
+        T.eq("Ctz", y::bits::ctz(u64(1) << 45), 45u);
+        T.eq("Rotl", y::bits::rotl(u8(0b1000'0001), 1), u8(0b0000'0011));
+        T.eq("Rotr", y::bits::rotr(u32(1), 1), 0x8000'0000u);
+        T.eq("Reverse u8", y::bits::reverse(u8(0b0000'0110)), u8(0b0110'0000));
+        T.eq("Reverse u64", y::bits::reverse(u64(1)), u64(1) << 63);
+        T.eq("Reverse u32", y::bits::reverse(0x1234'5678u), 0x1E6A'2C48u);
+        T.eq("Next pow2", y::bits::next_pow2(17u), 32u);
+        T.eq("Next pow2 exact", y::bits::next_pow2(u64(1) << 40), u64(1) << 40);
+        T.ok("Is pow2", y::bits::is_pow2(64u) && !y::bits::is_pow2(0u) && !y::bits::is_pow2(96u));
+        T.eq("Pdep", y::bits::pdep(0b101, 0b1101'0000), u64(0b1001'0000));
+        T.eq("Pext", y::bits::pext(0b1001'0000, 0b1101'0000), u64(0b101));
+        T.eq("Select", y::bits::select(0b1011'0100, 2), 5u);
+        T.eq("Select past", y::bits::select(0b1011'0100, 4), 64u);
+
+        b8 round_trip = true;
+        y::Rng rng { 9 };
+        for (i32 i = 0; i < 1000; ++i) {
+            u64 const v = rng.next(), mask = rng.next() & rng.next();
+            round_trip = round_trip && y::bits::pdep(y::bits::pext(v, mask), mask) == (v & mask);
+        }
+        T.ok("Pdep / Pext", round_trip);
+    }
+
+    T.make_section("Bit Vec");
+    {
+        y::BitVec a { 1000 }, b { 1000, true };
+        T.eq("Size", a.size(), 1000);
+        T.ok("None", a.none() && b.all());
+        T.eq("Count all", b.count(), 1000);
+
+        Vec<b8> ref_a(1000), ref_b(1000, true);
+        y::Rng rng { 4 };
+        for (usize i = 0; i < 1000; ++i) {
+            ref_a[i] = rng.chance(0.3f);
+            a.set(i, ref_a[i]);
+            if (rng.chance(0.5f)) {
+                ref_b[i] = false;
+                b.reset(i);
+            }
+        }
+        auto const count_ref = [](Vec<b8> const &v) { return usize(std::count(v.begin(), v.end(), true)); };
+        T.eq("Count", a.count(), count_ref(ref_a));
+
+        b8 ops_ok = true;
+        y::BitVec const and_ab = a & b, or_ab = a | b, xor_ab = a ^ b;
+        for (usize i = 0; i < 1000; ++i) {
+            ops_ok = ops_ok && and_ab[i] == (ref_a[i] && ref_b[i]) && or_ab[i] == (ref_a[i] || ref_b[i])
+                     && xor_ab[i] == (ref_a[i] != ref_b[i]);
+        }
+        T.ok("And / Or / Xor", ops_ok);
+
+        y::BitVec flipped = a;
+        flipped.flip_all();
+        T.eq("Flip all", flipped.count(), 1000 - a.count());
+        flipped.resize(1003, true);
+        T.eq("Resize fill", flipped.count(), 1003 - a.count());
+        flipped.resize(10);
+        flipped.resize(70);
+        T.eq("Resize clears", (flipped ^ flipped).count() + flipped.count(), 10 - usize(std::count(ref_a.begin(), ref_a.begin() + 10, true)));
+
+        Vec<usize> set_bits;
+        a.for_each_set([&](usize i) { set_bits.push_back(i); });
+        T.eq("For each set", set_bits.size(), a.count());
+
+        a.build_index();
+        b8 rank_ok = true, select_ok = true;
+        usize ones = 0;
+        for (usize i = 0; i <= 1000; ++i) {
+            rank_ok = rank_ok && a.rank(i) == ones;
+            if (i < 1000 && ref_a[i]) {
+                select_ok = select_ok && a.select(ones) == i;
+                ++ones;
+            }
+        }
+        T.ok("Rank", rank_ok);
+        T.ok("Select", select_ok);
+        T.ok("Select past", !a.select(ones).has_value());
+
+        y::BitVec sparse { 5000 };
+        sparse.set(4999);
+        sparse.push_back(true);
+        sparse.build_index();
+        T.eq("Sparse select", sparse.select(1).value_or(0), 5000);
+        T.eq("Sparse rank", sparse.rank(5001), 2);
+    }
+
+    T.make_section("Radix Sort");
+    {
+        y::Rng rng { 11 };
+        Vec<u32> u(10000);
+        rng.fill(Span<u32> { u });
+        Vec<u32> u_ref = u;
+        std::sort(u_ref.begin(), u_ref.end());
+        y::radix_sort(u);
+        T.ok("u32", u == u_ref);
+
+        Vec<i64> i(5000);
+        for (i64 &v : i) {
+            v = rng.uniform<i64>(-1'000'000'000'000, 1'000'000'000'000);
+        }
+        Vec<i64> i_ref = i;
+        std::sort(i_ref.begin(), i_ref.end());
+        y::radix_sort(i);
+        T.ok("i64", i == i_ref);
+
+        Vec<i8> small { 5, -3, 127, -128, 0, -1, 1 };
+        y::radix_sort(small);
+        T.ok("i8 small", small == Vec<i8> { -128, -3, -1, 0, 1, 5, 127 });
+
+        Vec<f32> f(3000);
+        rng.fill(Span<f32> { f }, -100.f, 100.f);
+        f[0] = std::numeric_limits<f32>::infinity();
+        f[1] = -std::numeric_limits<f32>::infinity();
+        f[2] = -0.f;
+        f[3] = 0.f;
+        Vec<f32> f_ref = f;
+        std::sort(f_ref.begin(), f_ref.end());
+        y::radix_sort(f);
+        T.ok("f32", f == f_ref && std::signbit(f[usize(std::find(f.begin(), f.end(), 0.f) - f.begin())]));
+
+        Vec<f64> d { 2.5, -1e300, 0.125, -0.5, 1e-300, 3.0 };
+        y::radix_sort(d);
+        T.ok("f64", std::is_sorted(d.begin(), d.end()));
+
+        Vec<u16> keys(2000);
+        Vec<u32> values(2000);
+        for (usize k = 0; k < keys.size(); ++k) {
+            keys[k] = u16(rng.uniform<u32>(0, 50));
+            values[k] = u32(k);
+        }
+        Vec<u16> const original = keys;
+        y::radix_sort(keys, values);
+        b8 stable = std::is_sorted(keys.begin(), keys.end());
+        for (usize k = 0; k < keys.size(); ++k) {
+            stable = stable && original[values[k]] == keys[k] && (k == 0 || keys[k - 1] != keys[k] || values[k - 1] < values[k]);
+        }
+        T.ok("Key value stable", stable);
+
+        Vec<u32> const order = y::radix_order(original);
+        T.ok("Order", order == values);
+
+        // Above 'radix_msd_min' : MSD pass, then LSD per bucket
+        Vec<i32> wide(200'000);
+        for (i32 &v : wide) {
+            v = rng.uniform<i32>(-100'000, 100'000);
+        }
+        Vec<i32> sorted_wide = wide;
+        Vec<u32> wide_values(wide.size());
+        std::iota(wide_values.begin(), wide_values.end(), 0u);
+        y::radix_sort(sorted_wide, wide_values);
+        b8 wide_stable = std::is_sorted(sorted_wide.begin(), sorted_wide.end());
+        for (usize k = 1; k < wide.size(); ++k) {
+            wide_stable = wide_stable && wide[wide_values[k]] == sorted_wide[k] &&
+                          (sorted_wide[k - 1] != sorted_wide[k] || wide_values[k - 1] < wide_values[k]);
+        }
+        T.ok("Key value stable, bucketed", wide_stable && y::radix_order(wide) == wide_values);
+
+        Vec<u64> same(100'000, 42);
+        y::radix_sort(same);
+        T.ok("All equal", std::ranges::all_of(same, [](u64 v) { return v == 42; }));
+
+        Vec<Str> names { "c", "a", "b" };
+        Vec<u64> ranks { 30, 10, 20 };
+        y::radix_sort(ranks, names);
+        T.ok("Non trivial values", names == Vec<Str> { "a", "b", "c" });
+
+        Vec<u64> big(y::radix_parallel_min * 4);
+        for (u64 &v : big) {
+            v = rng.next() >> 20;
+        }
+        Vec<u64> big_ref = big;
+        std::sort(big_ref.begin(), big_ref.end());
+        y::radix_sort(big, true);
+        T.ok("Parallel", big == big_ref);
+    }
+
+    T.make_section("String Sort");
+    {
+        y::Rng rng { 21 };
+        Str const alphabet { "ab\0z\xff", 5 };
+        auto const random_str = [&] {
+            Str s = rng.chance(0.5f) ? "shared/prefix/longer/than/eight/" : "";
+            usize const len = rng.uniform<usize>(0, 20);
+            for (usize c = 0; c < len; ++c) {
+                s += alphabet[rng.uniform<usize>(0, alphabet.size() - 1)];
+            }
+            return s;
+        };
+
+        Vec<Str> strs(3000);
+        for (Str &s : strs) {
+            s = random_str();
+        }
+        strs.push_back("");
+        strs.push_back(Str { "ab\0", 3 });
+        strs.push_back("ab");
+        Vec<Str> ref = strs;
+        std::sort(ref.begin(), ref.end());
+        y::str_sort(Span<Str> { strs });
+        T.ok("Str", strs == ref);
+
+        Vec<StrView> views { "pear", "apple", "peach", "app", "", "apple", "pea" };
+        y::str_sort(Span<StrView> { views });
+        T.ok("StrView", views == Vec<StrView> { "", "app", "apple", "apple", "pea", "peach", "pear" });
+
+        Vec<Str> big(y::str_sort_parallel_min * 2);
+        for (Str &s : big) {
+            s = random_str();
+        }
+        Vec<Str> big_ref = big;
+        std::sort(big_ref.begin(), big_ref.end());
+        y::str_sort(Span<Str> { big }, true);
+        T.ok("Parallel", big == big_ref);
+
+        // Median of three killer : replays the partition so each round the pivot is the second smallest key. Without the
+        // depth limit every partition recurses into one as long as the input minus two
+        Vec<usize> order(20000);
+        std::iota(order.begin(), order.end(), usize(0));
+        Vec<u32> rank(order.size(), u32_max);
+        u32 next = 0;
+        for (usize lo = 0; order.size() - lo > 16;) {
+            Span<usize> const part = Span<usize> { order }.subspan(lo);
+            rank[part[0]] = next++;
+            rank[part[part.size() / 2]] = next++;
+            u32 const pivot = next - 1;
+            usize lt = 0, i = 0, gt = part.size();
+            while (i < gt) {
+                if (rank[part[i]] < pivot) {
+                    std::swap(part[lt++], part[i++]);
+                } else if (rank[part[i]] > pivot) {
+                    std::swap(part[i], part[--gt]);
+                } else {
+                    ++i;
+                }
+            }
+            lo += gt;
+        }
+        Vec<Str> killer(order.size());
+        for (usize id = 0; id < order.size(); ++id) {
+            u32 const r = rank[id] == u32_max ? next++ : rank[id];
+            killer[id] = Str { char(r >> 8), char(r & 0xFF) };
+        }
+        Vec<Str> killer_ref = killer;
+        std::sort(killer_ref.begin(), killer_ref.end());
+        y::str_sort(Span<Str> { killer });
+        T.ok("Bad Pivots", killer == killer_ref);
     }
 
 
@@ -145,6 +942,358 @@ int main() {
     }
 
 
+    T.make_section("Flat Map");
+    {
+        y::FlatMap<Str, i32> map { { "one", 1 }, { "two", 2 } };
+        map["three"] = 3;
+        T.eq("Size", map.size(), 3);
+        T.eq("Lookup", map.at("two"), 2);
+        T.ok("Transparent Lookup", map.contains(StrView("three")));
+        T.ok("Missing", map.find("four") == map.end());
+        T.ok("Try Emplace Existing", !map.try_emplace("one", 11).second);
+        T.eq("Insert Or Assign", map.insert_or_assign("one", 11).first->second, 11);
+        T.eq("Erase", map.erase(StrView("two")), 1);
+        T.eq("Erase Missing", map.erase("two"), 0);
+
+        y::FlatMap<i32, i32> ints {};
+        Umap<i32, i32> ref {};
+        ints.reserve(100);
+        T.gt_or_eq("Reserve", ints.capacity(), 100);
+        for (i32 i = 0; i < 5000; ++i) {
+            ints[i * 7] = i;
+            ref[i * 7] = i;
+            if (i % 3 == 0) {
+                ints.erase(i * 7 / 2);
+                ref.erase(i * 7 / 2);
+            }
+        }
+        b8 same = ints.size() == ref.size();
+        for (auto const &[k, v] : ref) {
+            auto const it = ints.find(k);
+            same &= it != ints.end() && it->second == v;
+        }
+        usize iterated = 0;
+        for (auto const &kv : ints) {
+            iterated += ref.contains(kv.first);
+        }
+        T.ok("Matches Umap", same && iterated == ref.size());
+
+        auto moved = std::move(ints);
+        T.eq("Move", moved.size(), ref.size());
+        auto copied = moved;
+        T.eq("Copy", copied.at(7), 1);
+
+        y::FlatSet<Str> set { "a", "b" };
+        set.emplace("c");
+        T.ok("Set Contains", set.contains("c") && !set.contains(StrView("d")));
+        T.eq("Set Size", set.size(), 3);
+    }
+
+
+    T.make_section("Flat Ordered Map");
+    {
+        y::FlatOmap<Str, i32> map { { "c", 3 }, { "a", 1 }, { "b", 2 }, { "a", 9 } };
+        T.eq("Bulk Unique", map.size(), 3);
+        T.eq("Bulk First Wins", map.at("a"), 1);
+        T.eq("Sorted", map.begin()->first, "a");
+        map["d"] = 4;
+        T.ok("Insert Existing", !map.insert({ "b", 20 }).second);
+        T.ok("Transparent Lookup", map.contains(StrView("d")));
+        T.eq("Lower Bound", map.lower_bound("bb")->first, "c");
+        T.eq("Upper Bound", map.upper_bound("c")->first, "d");
+        T.eq("Erase", map.erase("c"), 1);
+        T.ok("Missing", map.find("c") == map.end());
+        map["a"] += 1;
+        map.try_emplace(StrView("b"), 20);
+        T.ok("Heterogeneous Hits", map.size() == 3 && map.at("a") == 2 && map.at("b") == 2);
+        T.eq("Heterogeneous Insert", map.insert_or_assign(StrView("e"), 5).first->first, "e");
+
+        y::FlatOmap<CountedKey, i32, std::less<>> counted {};
+        counted[KeyProbe { "x" }] = 1;
+        counted[KeyProbe { "x" }] += 1;
+        counted.try_emplace(KeyProbe { "x" }, 7);
+        counted.insert_or_assign(KeyProbe { "y" }, 3);
+        T.eq("Hits Build No Key", CountedKey::built, 2);
+        T.eq("Hit Value", counted.at(KeyProbe { "x" }), 2);
+
+        y::FlatOmap<u64, i32> numbers {};
+        numbers[1] = 2;
+        numbers[u8(1)] += 1;
+        T.ok("Converted Keys", numbers.size() == 1 && numbers.at(1) == 3);
+
+        Vec<i32> input {};
+        for (i32 i = 0; i < 1000; ++i) {
+            input.push_back((i * 7919) % 500);
+        }
+        y::FlatOset<i32> set { input };
+        T.eq("Set Bulk Unique", set.size(), 500);
+        T.ok("Set Sorted", std::is_sorted(set.begin(), set.end()));
+        T.ok("Set Contains All", std::all_of(input.begin(), input.end(), [&](i32 v) { return set.contains(v); }));
+        T.ok("Set Missing", !set.contains(-1) && !set.contains(500));
+
+        auto const range = set.range(10, 20);
+        T.eq("Range Size", range.size(), 10);
+        T.eq("Range First", range.front(), 10);
+        T.ok("Range Empty", set.range(20, 10).empty());
+    }
+
+
+    T.make_section("BTree Map");
+    {
+        y::BTreeMap<Str, i32> names { { "b", 2 }, { "a", 1 } };
+        names["c"] = 3;
+        T.eq("Size", names.size(), 3);
+        T.eq("At", names.at("b"), 2);
+        T.eq("Ordered", names.begin()->first, "a");
+        T.eq("Last", std::prev(names.end())->first, "c");
+        T.ok("Transparent Lookup", names.contains(StrView("c")));
+        T.eq("Insert Or Assign", names.insert_or_assign("a", 10).first->second, 10);
+        for (auto &&[k, v] : names) {
+            v += 100;
+        }
+        i32 total = 0;
+        for (auto const &[k, v] : names) {
+            total += v;
+        }
+        T.eq("Loop Bindings", total, 110 + 102 + 103);
+
+        CountedKey::built = 0;
+        Vec<Str> labels {};
+        for (i32 i = 0; i < 300; ++i) {
+            labels.push_back(std::to_string(i * 7 % 300));
+        }
+        y::BTreeMap<CountedKey, i32, std::less<>> counted {};
+        for (Str const &label : labels) {
+            counted[KeyProbe { label }] = 1;
+        }
+        for (Str const &label : labels) {
+            counted[KeyProbe { label }] += 1;
+            counted.try_emplace(KeyProbe { label }, 7);
+        }
+        T.eq("Hits Build No Key", CountedKey::built, 300);
+        T.ok("Hit Values", std::all_of(labels.begin(), labels.end(), [&](Str const &label) {
+                 return counted.at(KeyProbe { label }) == 2;
+             }));
+
+        y::BTreeMap<u64, i32> numbers {};
+        numbers[1] = 2;
+        numbers[u8(1)] += 1;
+        numbers.insert_or_assign(i32(1), 4);
+        T.ok("Converted Keys", numbers.size() == 1 && numbers.at(1) == 4);
+
+        y::BTreeMap<i32, i32> tree {};
+        Omap<i32, i32> ref {};
+        for (i32 i = 0; i < 20000; ++i) {
+            i32 const k = (i * 7919) % 10007;
+            tree[k] = i;
+            ref[k] = i;
+            if (i % 3 == 0) {
+                i32 const gone = (i * 31) % 10007;
+                tree.erase(gone);
+                ref.erase(gone);
+            }
+        }
+        b8 same = tree.size() == ref.size();
+        auto it = tree.begin();
+        for (auto const &[k, v] : ref) {
+            same &= it != tree.end() && it->first == k && it->second == v;
+            ++it;
+        }
+        T.ok("Matches Omap", same && it == tree.end());
+        T.ok("Lower Bound", tree.lower_bound(5000)->first == ref.lower_bound(5000)->first);
+        T.ok("Upper Bound", tree.upper_bound(5000)->first == ref.upper_bound(5000)->first);
+        T.ok("Missing", tree.find(-1) == tree.end() && tree.lower_bound(20000) == tree.end());
+
+        i32 scanned = 0;
+        for (auto r = tree.lower_bound(100); r != tree.end() && r->first < 200; ++r) {
+            ++scanned;
+        }
+        T.eq("Range Scan", scanned, std::distance(ref.lower_bound(100), ref.lower_bound(200)));
+
+        auto copied = tree;
+        for (i32 k = 0; k < 10007; ++k) {
+            tree.erase(k);
+        }
+        T.ok("Erase All", tree.empty() && tree.begin() == tree.end());
+        T.eq("Copy", copied.size(), ref.size());
+        tree[1] = 1;
+        T.eq("Reuse", tree.at(1), 1);
+    }
+
+
+    T.make_section("Small Vec");
+    {
+        y::SmallVec<Str, 4> v { "a", "b" };
+        T.ok("Inline", v.is_inline() && v.capacity() == 4);
+        v.push_back("c");
+        v.emplace_back("d");
+        T.ok("Still Inline", v.is_inline());
+        v.push_back(v[0]);
+        T.ok("Spilled", !v.is_inline() && v.size() == 5 && v.back() == "a");
+        v.insert(v.begin() + 1, "x");
+        v.erase(v.begin());
+        T.eq("Insert / Erase", v.front(), "x");
+        v.resize(3);
+        v.shrink_to_fit();
+        T.ok("Back Inline", v.is_inline() && v.size() == 3);
+
+        y::SmallVec<Str, 4> moved = std::move(v);
+        T.ok("Move", moved.size() == 3 && v.empty());
+        y::SmallVec<Str, 4> copied = moved;
+        T.ok("Copy", copied == moved);
+
+        SpanConst<Str> const span = moved;
+        T.eq("Span", span[2], "c");
+
+        y::SmallVec<i32, 2> ints {};
+        for (i32 i = 0; i < 100; ++i) {
+            ints.push_back(i);
+        }
+        T.ok("Grow", !ints.is_inline() && ints.size() == 100 && ints[99] == 99);
+
+        auto const split = y::str_split<y::SmallVec<Str, 8>>("1,2,3", ",");
+        T.ok("Split Into", split.is_inline() && split.size() == 3);
+        T.eq("Join", y::str_join(split, "-"), "1-2-3");
+        y::SmallVec<Str, 2> const from { "1", "3" };
+        y::SmallVec<Str, 2> const to { "one", "three" };
+        T.eq("Replace Many", y::str_replace_many("1,2,3", from, to), "one,2,three");
+    }
+
+
+    T.make_section("Soa Vec");
+    {
+        y::SoaVec<f32, i32, Str> soa;
+        for (i32 i = 0; i < 100; ++i) {
+            soa.push_back(f32(i), i * 2, Str(40, char('a' + i % 26)));
+        }
+        T.eq("Size", soa.size(), 100);
+        T.ok("Aligned", reinterpret_cast<uintptr_t>(soa.column<1>().data()) % 64 == 0 &&
+                          reinterpret_cast<uintptr_t>(soa.column<2>().data()) % 64 == 0);
+
+        f32 sum = 0.f;
+        for (f32 const f : soa.column<0>()) {
+            sum += f;
+        }
+        T.eq("Column", sum, 4950.f);
+
+        auto [f, i, str] = soa[3];
+        i = -1;
+        T.ok("Row", f == 3.f && soa.column<1>()[3] == -1 && str[0] == 'd');
+
+        soa.erase(0);
+        T.ok("Erase Keeps Order", std::get<1>(soa[0]) == 2 && std::get<1>(soa[1]) == 4 && std::get<1>(soa[2]) == -1);
+        soa.swap_erase(0);
+        T.ok("Swap Erase", std::get<1>(soa[0]) == 198 && std::get<2>(soa[0])[0] == 'v' && soa.size() == 98);
+
+        for (auto [ff, ii, ss] : soa) {
+            ii += 1;
+        }
+        T.eq("Iterate Writes", std::get<1>(soa[0]), 199);
+
+        auto const copy = soa;
+        auto moved = std::move(soa);
+        T.ok("Copy / Move", copy.size() == 98 && moved.size() == 98 && soa.empty() &&
+                              std::get<2>(copy[50]) == std::get<2>(moved[50]));
+
+        moved.resize(10);
+        moved.resize(12);
+        T.ok("Resize", moved.size() == 12 && std::get<2>(moved[11]).empty() && std::get<1>(moved[9]) != 0);
+
+        y::SoaVec<i32, Str> self;
+        self.push_back(7, Str(40, 'x'));
+        while (self.size() < self.capacity()) {
+            self.push_back(0, "");
+        }
+        self.emplace_back(self.column<0>()[0], self.column<1>()[0]);
+        T.ok("Grow From Own Elements", self.size() == 9 && std::get<0>(self[self.size() - 1]) == 7 &&
+                                           std::get<1>(self[self.size() - 1]) == Str(40, 'x'));
+    }
+
+    T.make_section("Vec3 Batch");
+    {
+        Vec<Vec3> as, bs;
+        for (i32 i = 0; i < 103; ++i) { // Not a multiple of the SIMD width
+            as.emplace_back(f32(i), f32(i % 7) - 3.f, 1.f + f32(i) * 0.5f);
+            bs.emplace_back(2.f - f32(i % 5), f32(i) * 0.25f, 3.f);
+        }
+        y::Vec3Batch const a { as };
+        y::Vec3Batch const b { bs };
+        T.ok("Round Trip", a.to_vec() == as && reinterpret_cast<uintptr_t>(a.ys().data()) % 64 == 0);
+
+        auto const sum = a + b;
+        auto const prod = a * b;
+        auto const scaled = a * 2.f;
+        auto const crossed = y::cross(a, b);
+        auto const normalized = y::normalize(a);
+        auto const dots = y::dot(a, b);
+        auto const lengths = y::length(a);
+        b8 all_match = true;
+        for (usize i = 0; i < as.size(); ++i) {
+            all_match = all_match && y::fuzzy_eq(sum[i], as[i] + bs[i]) && y::fuzzy_eq(prod[i], as[i] * bs[i]) &&
+                        y::fuzzy_eq(scaled[i], as[i] * 2.f) && y::fuzzy_eq(crossed[i], glm::cross(as[i], bs[i])) &&
+                        y::fuzzy_eq(normalized[i], glm::normalize(as[i])) &&
+                        y::fuzzy_eq(dots[i], glm::dot(as[i], bs[i])) && y::fuzzy_eq(lengths[i], glm::length(as[i]));
+        }
+        T.ok("Kernels", all_match);
+
+        T.ok("Fuzzy Eq", y::fuzzy_eq(sum - b, a) && !y::fuzzy_eq(sum, a));
+        T.ok("Is Aligned", y::is_aligned(a, scaled) && !y::is_aligned(a, b));
+
+        Vec<Vec3> with_zero = as;
+        with_zero[50] = Vec3(0.f);
+        y::Vec3Batch const z { with_zero };
+        T.ok("Zero Vector Not Aligned", !y::is_aligned(z, z) && !y::is_aligned(y::Vec3Batch { Vec<Vec3> { Vec3(0.f) } },
+                                                                               y::Vec3Batch { Vec<Vec3> { Vec3(1.f, 0.f, 0.f) } }) &&
+                                            !y::is_aligned(Vec3(0.f), Vec3(1.f, 0.f, 0.f)));
+    }
+
+    T.make_section("Transform Points");
+    {
+        Mat4 m = glm::translate(Mat4(1.f), Vec3(1.f, -2.f, 3.f));
+        m = glm::rotate(m, 0.7f, Vec3(0.3f, 1.f, -0.5f));
+        m = glm::scale(m, Vec3(2.f, 0.5f, 1.5f));
+
+        Vec<Vec3> points;
+        Vec<Vec4> points4;
+        for (i32 i = 0; i < 1001; ++i) {
+            points.emplace_back(f32(i % 17), f32(i % 5) - 2.f, f32(i) * 0.01f);
+            points4.emplace_back(points.back(), f32(i % 3));
+        }
+
+        Vec<Vec3> out_points(points.size());
+        Vec<Vec3> out_dirs(points.size());
+        Vec<Vec4> out4(points4.size());
+        y::transform_points(m, points, out_points);
+        y::transform_dirs(m, points, out_dirs);
+        y::transform_points(m, points4, out4);
+        auto const batch = y::transform_points(m, y::Vec3Batch(points));
+        auto const batch_dirs = y::transform_dirs(m, y::Vec3Batch(points));
+
+        b8 all_match = true;
+        for (usize i = 0; i < points.size(); ++i) {
+            Vec4 const p = m * Vec4(points[i], 1.f);
+            Vec4 const d = m * Vec4(points[i], 0.f);
+            all_match = all_match && y::fuzzy_eq(out_points[i], Vec3(p.x, p.y, p.z)) &&
+                        y::fuzzy_eq(out_dirs[i], Vec3(d.x, d.y, d.z)) && y::fuzzy_eq(out4[i], m * points4[i]) &&
+                        y::fuzzy_eq(batch[i], out_points[i]) && y::fuzzy_eq(batch_dirs[i], out_dirs[i]);
+        }
+        T.ok("Points / Dirs / Vec4 / Batch", all_match);
+
+        // Above 'transform_parallel_min', in place
+        Vec<Vec3> big(y::transform_parallel_min * 2 + 3);
+        for (usize i = 0; i < big.size(); ++i) {
+            big[i] = Vec3(f32(i % 101), 1.f, -f32(i % 7));
+        }
+        Vec<Vec3> const original = big;
+        y::transform_points(m, big, big);
+        b8 big_match = true;
+        for (usize i = 0; i < big.size(); i += 997) {
+            Vec4 const p = m * Vec4(original[i], 1.f);
+            big_match = big_match && y::fuzzy_eq(big[i], Vec3(p.x, p.y, p.z));
+        }
+        T.ok("Parallel In Place", big_match && y::fuzzy_eq(big.back(), batch[0]) == y::fuzzy_eq(original.back(), points[0]));
+    }
+
     T.make_section("Elapsed Timer");
     {
         using namespace std::chrono_literals;
@@ -183,6 +1332,7 @@ int main() {
             from = { ".", "-", ":", "·" };
             to = { "[1] ", "[2] ", "[3] ", "[4] " };
             T.eq("Replace Many Sorted", y::str_replace_many(s, from, to, true), s_ok);
+            T.eq("Replace Many Braced", y::str_replace_many("a-b", { "-" }, { "+" }), "a+b");
         }
 
         {
@@ -190,6 +1340,7 @@ int main() {
             Vec<Str> const s_res = { "1", "2", "3", "4", "5" };
             T.ok("Split", y::str_split(s, ",") == s_res);
             T.ok("Join", y::str_join(s_res, ",") == s);
+            T.ok("Join Braced", y::str_join({ "1", "2", "3", "4", "5" }, ",") == s);
         }
 
         {
@@ -209,6 +1360,229 @@ int main() {
     }
 
 
+    T.make_section("Arena");
+    {
+        y::Arena arena { 256 };
+        auto *const a = arena.make<f64>(1.5);
+        void *const aligned = arena.alloc(8, 64);
+        T.eq("Make", *a, 1.5);
+        T.eq("Alignment", reinterpret_cast<uintptr_t>(aligned) % 64, 0);
+
+        auto const mark = arena.mark();
+        void *const first = arena.alloc(100);
+        (void)arena.alloc(1000); // Bigger than a chunk
+        arena.rewind(mark);
+        T.ok("Rewind Reuses", arena.alloc(100) == first);
+
+        usize const capacity = arena.capacity();
+        arena.reset();
+        for (i32 i = 0; i < 8; ++i) {
+            (void)arena.alloc(100);
+        }
+        T.eq("Reset Keeps Chunks", arena.capacity(), capacity);
+
+        {
+            y::pmr::Vec<i32> ints { &arena };
+            for (i32 i = 0; i < 100; ++i) {
+                ints.push_back(i);
+            }
+            T.eq("Pmr Vec", ints[99], 99);
+
+            auto const split = y::str_split("a,bb,ccc", ",", &arena);
+            T.ok("Split", split.size() == 3 && split[2] == "ccc" && split.get_allocator().resource() == &arena);
+            auto const joined = y::str_join(split, " / ", &arena);
+            T.eq("Join", joined, "a / bb / ccc");
+            T.eq("StrView Copy", arena.copy("copied"), "copied");
+        }
+
+        arena.release();
+        T.eq("Release", arena.capacity(), 0);
+    }
+
+    T.make_section("Scratch");
+    {
+        auto const before = y::scratch().mark();
+        {
+            y::ScratchScope const scope;
+            y::pmr::Str tmp { "scratch string long enough to skip small buffer optimization", &scope.arena() };
+            T.ok("Allocates", y::scratch().mark().offset != before.offset);
+            {
+                y::ScratchScope const nested;
+                y::pmr::Vec<i32> ints(1000, 7, &nested.arena());
+                auto const parts = y::str_split("a,b", ",", nested);
+                T.eq("Nested", ints[999], 7);
+                T.eq("Nested Split", parts.size(), 2);
+            }
+            T.eq("Outer Alive", StrView(tmp), "scratch string long enough to skip small buffer optimization");
+        }
+        auto const after = y::scratch().mark();
+        T.ok("Rewound", after.chunk == before.chunk && after.offset == before.offset);
+
+        y::Arena *other = nullptr;
+        std::thread([&] { other = &y::scratch(); }).join();
+        T.ok("Per Thread", other != &y::scratch());
+    }
+
+
+    T.make_section("Pool");
+    {
+        static i32 s_alive = 0;
+        struct Obj {
+            i32 value = 0;
+            explicit Obj(i32 v) : value(v) { ++s_alive; }
+            ~Obj() { --s_alive; }
+        };
+
+        y::Pool<Obj, 16> pool;
+        Vec<Obj *> objs;
+        for (i32 i = 0; i < 100; ++i) {
+            objs.push_back(pool.make(i));
+        }
+        T.eq("Make", objs[42]->value, 42);
+        T.eq("Alive", s_alive, 100);
+        T.eq("Capacity", pool.capacity(), 112);
+
+        for (usize i = 0; i < objs.size(); i += 2) {
+            pool.destroy(objs[i]);
+        }
+        T.eq("Destroy", s_alive, 50);
+        T.ok("Reuse", pool.make(-1) == objs[98] && pool.capacity() == 112);
+        T.eq("Size", pool.size(), 51);
+        {
+            auto const ptr = pool.make_ptr(7);
+            T.eq("Ptr", ptr->value, 7);
+        }
+        T.eq("Ptr Release", pool.size(), 51);
+    }
+
+    T.make_section("Slot Map");
+    {
+        y::SlotMap<Str> map;
+        auto const a = map.insert("a");
+        auto const b = map.insert("b");
+        auto const c = map.emplace(3, 'c');
+        T.eq("Get", *map.get(c), "ccc");
+        T.eq("Size", map.size(), 3);
+
+        T.ok("Erase", map.erase(a));
+        T.ok("Erase Stale", !map.erase(a));
+        T.ok("Stale Get", map.get(a) == nullptr);
+        T.eq("Others Kept", map[b] + map[c], "bccc");
+
+        auto const d = map.insert("d");
+        T.ok("Slot Reused", d.index == a.index && d.gen != a.gen && !map.contains(a));
+        T.ok("Handle At", &map[map.handle_at(0)] == &*map.begin());
+
+        Str joined;
+        for (auto const &str : map) {
+            joined += str;
+        }
+        T.eq("Dense Iteration", joined.size(), 5);
+
+        // Random churn against a Umap of handles
+        y::SlotMap<i32> ints;
+        y::Umap<y::SlotHandle, i32> ref;
+        u32 seed = 7;
+        for (i32 i = 0; i < 5000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            if (ref.empty() || seed % 3 != 0) {
+                ref[ints.insert(i)] = i;
+            } else {
+                auto const it = std::next(ref.begin(), isize(seed >> 8) % isize(ref.size()));
+                ints.erase(it->first);
+                ref.erase(it);
+            }
+        }
+        b8 all_match = ints.size() == ref.size();
+        for (auto const &[handle, value] : ref) {
+            all_match = all_match && ints.contains(handle) && ints[handle] == value;
+        }
+        for (usize i = 0; i < ints.size(); ++i) {
+            all_match = all_match && ints[ints.handle_at(i)] == ints.values()[i];
+        }
+        T.ok("Churn", all_match);
+
+        ints.clear();
+        T.ok("Clear", ints.empty() && !ints.contains(ref.begin()->first));
+    }
+
+    T.make_section("Rc / Arc");
+    {
+        static i32 s_alive = 0;
+        struct Obj {
+            i32 value = 0;
+            explicit Obj(i32 v) : value(v) { ++s_alive; }
+            ~Obj() { --s_alive; }
+        };
+
+        {
+            auto const a = y::rc_new<Obj>(5);
+            auto b = a;
+            T.eq("Shared", b->value, 5);
+            T.eq("Count", a.use_count(), 2);
+            auto c = std::move(b);
+            T.ok("Move", !b && c == a && a.use_count() == 2);
+            c.reset();
+            T.eq("Reset", a.use_count(), 1);
+        }
+        T.eq("Freed", s_alive, 0);
+
+        {
+            y::Rc<Obj>::BoxPool pool;
+            Vec<y::Rc<Obj>> rcs;
+            for (i32 i = 0; i < 100; ++i) {
+                rcs.push_back(y::rc_new<Obj>(pool, i));
+            }
+            rcs.push_back(rcs[50]);
+            T.eq("Pool", pool.size(), 100);
+            rcs.clear();
+            T.eq("Pool Freed", pool.size(), 0);
+        }
+        T.eq("Pool Alive", s_alive, 0);
+
+        {
+            auto const shared = y::arc_new<Obj>(1);
+            Vec<std::thread> threads;
+            for (i32 t = 0; t < 4; ++t) {
+                threads.emplace_back([shared] {
+                    for (i32 i = 0; i < 1000; ++i) {
+                        auto const copy = shared;
+                        (void)copy;
+                    }
+                });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            T.eq("Arc Count", shared.use_count(), 1);
+        }
+        T.eq("Arc Freed", s_alive, 0);
+    }
+
+    T.make_section("Interning");
+    {
+        y::Interner interner {};
+        y::Symbol const a = interner.intern("alpha");
+        y::Symbol const b = interner.intern(Str("beta"));
+
+        T.ok("Same Symbol", interner.intern("alpha") == a);
+        T.ok("Different Symbol", a != b);
+        T.eq("Size", interner.size(), 2);
+        T.eq("Back Reference", interner.str(b), "beta");
+        T.ok("Stable View", interner.str(a).data() == interner.str(interner.intern("alpha")).data());
+        T.ok("Find", interner.find("beta") == b);
+        T.ok("Find Missing", !interner.find("gamma").has_value());
+        T.ok("Invalid Symbol", interner.str(y::Symbol {}).empty());
+
+        y::InternerMt interner_mt { 8 };
+        for (i32 i = 0; i < 64; ++i) {
+            (void)interner_mt.intern(y_fmt("sym_{}", i % 16));
+        }
+        T.eq("Thread-Safe Size", interner_mt.size(), 16);
+        T.eq("Thread-Safe Str", interner_mt.str(interner_mt.intern("sym_3")), "sym_3");
+    }
+
+
     T.make_section("Files Ops");
     {
         auto constexpr s_write_bin { "./tests/output/to_file_write.bin" };
@@ -219,6 +1593,9 @@ int main() {
             Str const content = y::file_read(s_read_txt);
             Str const expected = "Test\nFile\nFor\nTesting\nFile\nReading\n";
             T.eq("Read", content, expected);
+
+            y::Arena arena {};
+            T.eq("Read Arena", StrView(y::file_read(s_read_txt, &arena)), StrView(expected));
         }
 
         {
@@ -0,0 +1,135 @@
+
+#define yyEnable_Aliases
+#define yyEnable_Testing
+#include <y.hpp>
+
+// Accuracy of 'y::fast' against libm (in f64) over each function whole useful range.
+// Bounds match the ones documented in 'y.hpp'.
+
+namespace {
+
+struct Sweep {
+    Vec<f32> in;
+    Vec<f32> out;
+};
+
+Sweep linspace(f64 lo, f64 hi, usize count) {
+    Sweep sweep { Vec<f32>(count), Vec<f32>(count) };
+    for (usize i = 0; i < count; ++i) {
+        sweep.in[i] = f32(lo + (hi - lo) * f64(i) / f64(count - 1));
+    }
+    return sweep;
+}
+
+/// Every positive normal f32, strided
+Sweep normals(u32 stride) {
+    Sweep sweep;
+    for (u32 bits = 0x00800000u; bits < 0x7F800000u; bits += stride) {
+        sweep.in.push_back(std::bit_cast<f32>(bits));
+    }
+    sweep.out.resize(sweep.in.size());
+    return sweep;
+}
+
+/// Max error of both the scalar and the span versions
+template <typename Scalar, typename Ref>
+f64 max_error(Sweep const &sweep, Scalar &&scalar, Ref &&ref, b8 relative) {
+    f64 max = 0.0;
+    for (usize i = 0; i < sweep.in.size(); ++i) {
+        f64 const expected = ref(f64(sweep.in[i]));
+        for (f32 const got : { sweep.out[i], scalar(sweep.in[i]) }) {
+            f64 const err = std::abs(f64(got) - expected);
+            max = std::max(max, relative ? err / std::abs(expected) : err);
+        }
+    }
+    return max;
+}
+
+} // namespace
+
+int main() {
+
+    y::Test T {};
+
+
+    T.make_section("Sin / Cos");
+    {
+        for (f64 const range : { 100.0, 1e5 }) {
+            f64 const bound = range <= 100.0 ? 2e-7 : 1.5e-6;
+
+            auto sweep = linspace(-range, range, 2'000'003);
+            y::fast::sin(sweep.in, sweep.out);
+            auto const sin_err = max_error(sweep, [](f32 x) { return y::fast::sin(x); }, [](f64 x) { return std::sin(x); }, false);
+            T.lt_or_eq(y_fmt("Sin |x| <= {}", range), sin_err, bound);
+
+            y::fast::cos(sweep.in, sweep.out);
+            auto const cos_err = max_error(sweep, [](f32 x) { return y::fast::cos(x); }, [](f64 x) { return std::cos(x); }, false);
+            T.lt_or_eq(y_fmt("Cos |x| <= {}", range), cos_err, bound);
+        }
+    }
+
+
+    T.make_section("Exp");
+    {
+        auto sweep = linspace(-87.3, 88.3, 2'000'003);
+        y::fast::exp(sweep.in, sweep.out);
+        auto const err = max_error(sweep, [](f32 x) { return y::fast::exp(x); }, [](f64 x) { return std::exp(x); }, true);
+        T.lt_or_eq("Relative", err, 2e-7);
+        T.ok("Clamped", y::fast::exp(-1000.f) > 0.f && y::fast::exp(1000.f) < f32_max);
+    }
+
+
+    T.make_section("Log");
+    {
+        auto small = linspace(1e-6, 10.0, 2'000'003);
+        y::fast::log(small.in, small.out);
+        auto const small_err = max_error(small, [](f32 x) { return y::fast::log(x); }, [](f64 x) { return std::log(x); }, false);
+        T.lt_or_eq("x <= 10", small_err, 6e-7);
+
+        auto all = normals(1021);
+        y::fast::log(all.in, all.out);
+        auto const all_err = max_error(all, [](f32 x) { return y::fast::log(x); }, [](f64 x) { return std::log(x); }, false);
+        T.lt_or_eq("Every Normal", all_err, 5e-6);
+    }
+
+
+    T.make_section("Rsqrt");
+    {
+        auto all = normals(1021);
+        y::fast::rsqrt(all.in, all.out);
+        auto const err = max_error(all, [](f32 x) { return y::fast::rsqrt(x); }, [](f64 x) { return 1.0 / std::sqrt(x); }, true);
+#ifdef __yHasSse2
+        T.lt_or_eq("Every Normal", err, 5e-7);
+#else
+        T.lt_or_eq("Every Normal", err, 5e-6);
+#endif
+    }
+
+
+    T.make_section("Atan2");
+    {
+        usize const side = 1001;
+        Vec<f32> ys, xs;
+        for (usize i = 0; i < side; ++i) {
+            for (usize j = 0; j < side; ++j) {
+                // Every quadrant and magnitude ratio, away from signed zeros
+                ys.push_back((f32(i) - f32(side / 2)) * 0.37f + 0.001f);
+                xs.push_back((f32(j) - f32(side / 2)) * 0.41f);
+            }
+        }
+        Vec<f32> out(ys.size());
+        y::fast::atan2(ys, xs, out);
+
+        f64 max = 0.0;
+        for (usize i = 0; i < ys.size(); ++i) {
+            f64 const expected = std::atan2(f64(ys[i]), f64(xs[i]));
+            max = std::max({ max, std::abs(f64(out[i]) - expected), std::abs(f64(y::fast::atan2(ys[i], xs[i])) - expected) });
+        }
+        T.lt_or_eq("Abs", max, 3e-6);
+        T.eq("Origin", y::fast::atan2(0.f, 0.f), 0.f);
+    }
+
+
+    T.show_results();
+    return T.cli_result();
+}